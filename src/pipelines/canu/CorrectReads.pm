@@ -250,6 +250,7 @@ sub buildCorrectionLayoutsConfigure ($) {
             $cmd .= "  -S ../../$asm.seqStore \\\n";
             $cmd .= "  -O    ../$asm.ovlStore \\\n";
             $cmd .= "  -scores ./$asm.globalScores.WORKING \\\n";
+            $cmd .= "  -t " . getGlobal("executiveThreads") . " \\\n";
             $cmd .= "  -c " . getCorCov($asm, "Global") . " \\\n";
             $cmd .= "  -l " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
             $cmd .= "  -e " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
@@ -293,6 +294,7 @@ sub buildCorrectionLayoutsConfigure ($) {
     $cmd .= "  -S ../$asm.seqStore \\\n";
     $cmd .= "  -O  ./$asm.ovlStore \\\n";
     $cmd .= "  -C  ./$asm.corStore.WORKING \\\n";
+    $cmd .= "  -t  " . getGlobal("executiveThreads") . " \\\n";
     $cmd .= "  -scores 2-correction/$asm.globalScores \\\n"         if (-e "$path/$asm.globalScores");
     $cmd .= "  -eL " . getGlobal("corMinEvidenceLength") . " \\\n"  if (defined(getGlobal("corMinEvidenceLength")));
     $cmd .= "  -eE " . getGlobal("corMaxEvidenceErate")  . " \\\n"  if (defined(getGlobal("corMaxEvidenceErate")));
@@ -775,6 +777,7 @@ sub dumpCorrectedReads ($) {
         $cmd .= "  -corrected \\\n";
         $cmd .= "  -S ./$asm.seqStore \\\n";
         $cmd .= "  -o ./$asm.correctedReads.gz \\\n";
+        $cmd .= "  -threads " . getGlobal("executiveThreads") . " \\\n";
         $cmd .= "  -fasta \\\n";
         $cmd .= "  -nolibname \\\n";
         $cmd .= "> $asm.correctedReads.fasta.err 2>&1";
@@ -986,6 +986,8 @@ sub setDefaults () {
 
     #  ovbMemory and ovsMemory are set above.
 
+    setDefault("ovsCompress",       0,   "Compress overlap store data files; smaller stores, but more CPU to load overlaps; default 'false'");
+
     #####  Executive
 
     setDefault("executiveMemory",   4,   "Amount of memory, in GB, to reserve for the Canu exective process");
@@ -640,6 +640,24 @@ sub merylConfigure ($$) {
     print F "  rm -f ./$name.??.dump\n";
     print F "fi\n";
     print F "\n";
+
+    if (getGlobal("${tag}Overlapper") eq "ovl") {
+        print F "#\n";
+        print F "#  Dump the same mers as a binary list for overlapInCore.\n";
+        print F "#\n";
+        print F "\n";
+        print F "if [ ! -e ./$name.skip ] ; then\n";
+        print F "  $bin/meryl threads=$thr memory=$merylMemory \\\n";
+        print F "    print-binary ./$name.##.skip \\\n";
+        print F "      at-least distinct=$mdistinct \\\n"         if (defined($mdistinct));
+        print F "      at-least threshold=$mthresh \\\n"          if (defined($mthresh));
+        print F "        ./$name\n";
+        print F "\n";
+        print F "  cat ./$name.??.skip > ./$name.skip\n";
+        print F "  rm -f ./$name.??.skip\n";
+        print F "fi\n";
+        print F "\n";
+    }
     print F "#\n";
     print F "#  Convert the dumped kmers into a mhap ignore list.\n";
     print F "#\n";
@@ -675,6 +693,7 @@ sub merylConfigure ($$) {
         print F "#  Save the overlapInCore ignore file.\n";
         print F "\n";
         print F stashFileShellCode($path, "$name.dump", "");
+        print F stashFileShellCode($path, "$name.skip", "")   if (getGlobal("${tag}Overlapper") eq "ovl");
 
         print F "\n";
         print F "#  Save the mhap ignore file.\n";
@@ -157,6 +157,12 @@ sub overlapConfigure ($$$) {
         my $hashBits       = getGlobal("${tag}OvlHashBits");
         my $hashLoad       = getGlobal("${tag}OvlHashLoad");
 
+        #  Use the binary skip list if meryl made one; user-supplied frequent mers are text only.
+
+        my $skipFile       = "$asm.ms$merSize.dump";
+
+        $skipFile = "$asm.ms$merSize.skip"   if (fileExists("$base/0-mercounts/$asm.ms$merSize.skip"));
+
         open(F, "> $path/overlap.sh") or caExit("can't open '$path/overlap.sh' for writing: $!", undef);
         print F "#!" . getGlobal("shell") . "\n";
         print F "\n";
@@ -188,13 +194,13 @@ sub overlapConfigure ($$$) {
         print F "  exit\n";
         print F "fi\n";
         print F "\n";
-        print F fetchFileShellCode("$base/0-mercounts", "$asm.ms$merSize.dump", "");
+        print F fetchFileShellCode("$base/0-mercounts", $skipFile, "");
         print F "\n";
         print F "\$bin/overlapInCore \\\n";
         print F "  -partial \\\n"  if ($type eq "partial");
         print F "  -t ", getGlobal("${tag}OvlThreads"), " \\\n";
         print F "  -k $merSize \\\n";
-        print F "  -k ../0-mercounts/$asm.ms$merSize.dump \\\n";
+        print F "  -k ../0-mercounts/$skipFile \\\n";
         print F "  --hashbits $hashBits \\\n";
         print F "  --hashload $hashLoad \\\n";
         print F "  --maxerate  ", getGlobal("corOvlErrorRate"), " \\\n"  if ($tag eq "cor");   #  Explicitly using proper name for grepability.
@@ -164,6 +164,8 @@ sub createOverlapStoreSequential ($$$) {
         print F " -O  ./$asm.ovlStore.BUILDING \\\n";
         print F" -S ../$asm.seqStore \\\n";
         print F " -C  ./$asm.ovlStore.config \\\n";
+        print F " -t  " . getGlobal("ovsThreads") . " \\\n";
+        print F " -z \\\n"   if (getGlobal("ovsCompress") == 1);
         print F " > ./$asm.ovlStore.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "mv ./$asm.ovlStore.BUILDING ./$asm.ovlStore\n";
@@ -357,7 +359,7 @@ sub createOverlapStoreParallel ($$$$$$) {
 
         if (defined(getGlobal("objectStore"))) {
             print F "#\n";
-            print F "#  Fetch all the input slices, and each sliceSizes file.\n";
+            print F "#  Fetch all the input slices, their counts, and each sliceSizes file.\n";
             print F "#\n";
             print F "\n";
             print F fetchSeqStoreShellCode($asm, $base, "");
@@ -383,6 +385,8 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -f \\\n";
         print F "  -s \$jobid \\\n";
+        print F "  -t  " . getGlobal("ovsThreads") . " \\\n";
+        print F "  -z \\\n"   if (getGlobal("ovsCompress") == 1);
         print F "  -M $sortMemory \n";
         print F "\n";
 
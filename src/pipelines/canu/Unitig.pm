@@ -255,6 +255,7 @@ sub unitig ($) {
         print F "  -noreadname \\\n";
         print F "  -fasta \\\n";
         print F "  -o $asm.input.gz \\\n";
+        print F "  -threads " . getGlobal("dbgThreads") . " \\\n"   if (defined(getGlobal("dbgThreads")));
         print F "&& \\\n";
         print F "mv -f $asm.input.fasta.gz $asm.fasta.gz\n";
         print F "if [ ! -e ./$asm.fasta.gz ] ; then\n";